@@ -3,9 +3,26 @@
     type = FileMeshGenerator
     file = fiber_64.e
   []
+  # tag both sides of the matrix/fiber interface before the mesh is broken;
+  # their nodes (duplicated by the break) form the interface split of
+  # fieldsplit.i
+  [matrix_side]
+    type = SideSetsBetweenSubdomainsGenerator
+    input = fiber_model_mesh
+    primary_block = 'Matrix'
+    paired_block = 'Fiber'
+    new_boundary = 'matrix_side'
+  []
+  [fiber_side]
+    type = SideSetsBetweenSubdomainsGenerator
+    input = matrix_side
+    primary_block = 'Fiber'
+    paired_block = 'Matrix'
+    new_boundary = 'fiber_side'
+  []
   [breakmesh]
     type = BreakMeshByBlockGenerator
-    input = fiber_model_mesh
+    input = fiber_side
     block_pars = 'Matrix Fiber'
     interface_name = matrix_fiber
   []
@@ -27,36 +44,19 @@
   []
 []
 [InterfaceKernels]
-  [ifk_x]
+  # one kernel assembles disp_x, disp_y, disp_z and their coupled blocks
+  [ifk]
     type = Rczm
-    component = 0
     variable = 'disp_x'
     neighbor_var = 'disp_x'
     displacements = 'disp_x disp_y disp_z'
+    assemble_all_components = true
+    # Matrix and Fiber are isotropic: one shear modulus per block pair
+    block_constant_modulus = true
     #boundary = 'interface'
     boundary = 'matrix_fiber'
     stabilized_para =2
   []
-  [ifk_y]
-  type = Rczm
-  component = 1
-  variable = 'disp_y'
-  neighbor_var = 'disp_y'
-    displacements = 'disp_x disp_y disp_z'
-  #boundary = 'interface'
-  boundary = 'matrix_fiber'
-  stabilized_para = 2
-  []
-  [ifk_z]
-  type = Rczm
-  component = 2
-  variable = 'disp_z'
-  neighbor_var = 'disp_z'
-    displacements = 'disp_x disp_y disp_z'
-  #boundary = 'interface'
-   boundary = 'matrix_fiber'
-  stabilized_para = 2
-  []
 []
 
 [Materials]
@@ -292,14 +292,74 @@
     boundary = Y_Plus
     variable = RF_Y
   []
+  # number of interface qps in each state of the interface state index
+  [Intact_Qps]
+    type = InterfaceStateCount
+    boundary = 'matrix_fiber'
+    state = intact
+  []
+  [Softening_Qps]
+    type = InterfaceStateCount
+    boundary = 'matrix_fiber'
+    state = softening
+  []
+  [Failed_Open_Qps]
+    type = InterfaceStateCount
+    boundary = 'matrix_fiber'
+    state = failed_open
+  []
+  [Failed_Contact_Qps]
+    type = InterfaceStateCount
+    boundary = 'matrix_fiber'
+    state = failed_contact
+  []
+  # onset and damage monitors driving the time stepper
+  [Max_Onset_Ratio]
+    type = InterfaceDamageMonitor
+    boundary = 'matrix_fiber'
+    quantity = max_onset_ratio
+  []
+  [Max_Damage_Increment]
+    type = InterfaceDamageMonitor
+    boundary = 'matrix_fiber'
+    quantity = max_damage_increment
+  []
+  [Newly_Softened_Qps]
+    type = InterfaceDamageMonitor
+    boundary = 'matrix_fiber'
+    quantity = newly_softened
+  []
+  # interface qps assembled by ifk in each branch during the last residual evaluation
+  [DG_Intact_Branch]
+    type = InterfaceBranchCount
+    interface_kernel = ifk
+    branch = dg_intact
+  []
+  [Cohesive_Branch]
+    type = InterfaceBranchCount
+    interface_kernel = ifk
+    branch = cohesive_softening
+  []
+  [Failed_Branch]
+    type = InterfaceBranchCount
+    interface_kernel = ifk
+    branch = failed
+  []
+  [Tied_Contact_Branch]
+    type = InterfaceBranchCount
+    interface_kernel = ifk
+    branch = tied_contact
+  []
 []
 
 [Problem]
   extra_tag_vectors = react
 []
 
+# direct LU solve; for the interface/bulk field split instead run
+#   kitfox-opt -i model_fiber_64_biaxis.i fieldsplit.i
 [Preconditioning]
-  [SMP]
+  [pc]
     type = SMP
     full = true
   []
@@ -310,7 +370,14 @@
   #[Quadrature]
   # side_order = 'constant'
   #[]
-  dt = 0.005
+  [TimeStepper]
+    type = CohesiveOnsetTimeStepper
+    dt = 0.005
+    onset_ratio = Max_Onset_Ratio
+    damage_increment = Max_Damage_Increment
+    newly_softened = Newly_Softened_Qps
+    max_damage_increment = 0.05
+  []
   dtmax = 0.1
   dtmin = 0.000001
   end_time = 2
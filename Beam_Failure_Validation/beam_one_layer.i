@@ -73,6 +73,9 @@
   [./Rigid_czm_model]
     type = OrtizPandolfiRczm
     boundary = 'beam_bonding_interface'
+    # the only state_record setting: Rczm and Newly_Promoted_Qps read the
+    # promoted state from the material (active_interface_state)
+    state_record = in_step_softening
     maximum_effective_traction = 25.0
     maximum_effective_gap = 0.01508
     shear_weight = 0.707
@@ -250,6 +253,22 @@
     boundary = Left_Bottom
     variable = RF_Y
   []
+  # interface qps softened or failed by the last solve of the step alone;
+  # the fixed-point iterations stop once a solve promotes none
+  [Newly_Promoted_Qps]
+    type = InterfaceDamageMonitor
+    boundary = 'beam_bonding_interface'
+    quantity = newly_promoted
+  []
+[]
+
+[UserObjects]
+  # interface state reached by each solve; lets the crack advance
+  # several qp layers per time step through fixed-point iterations
+  [in_step_softening]
+    type = InterfaceStateRecord
+    boundary = 'beam_bonding_interface'
+  []
 []
 
 [Problem]
@@ -290,6 +309,15 @@
  # nl_rel_tol = 1e-8
 
    nl_abs_tol = 1e-8
+
+  # re-solve the step while new interface qps soften (at most 10 times);
+  # converged once a solve promotes no qp, so quiet steps take one solve
+  fixed_point_max_its = 10
+  custom_pp = Newly_Promoted_Qps
+  direct_pp_value = true
+  custom_abs_tol = 0.5
+  disable_fixed_point_residual_norm_check = true
+  accept_on_max_fixed_point_iteration = true
 []
 
 [Outputs]
@@ -0,0 +1,209 @@
+# Jacobian verification of the Rczm/DGSolid interface kernels and the
+# OrtizPandolfiRczm tangent on two blocks joined by one interface.
+# Run with NEWTON; PETSc compares the hand-coded Jacobian with a finite
+# difference one at every nonlinear iteration (-snes_test_jacobian) and
+# prints ||J - Jfd||_F/||J||_F. SMALL strain keeps the bulk Jacobian exact
+# so that only the interface is checked.
+# As is, this is the intact interface (DG branch) on the fused kernel;
+# run_jacobian_checks.py sets up the other branches with command line
+# overrides and fails on a ratio above its tolerance.
+
+# initial displacement of Right_Block along x, i.e. the initial interface
+# opening (> 0) or penetration (< 0), and the loading rate of the right face
+opening = 0
+rate = 0.001
+
+[Mesh]
+  [block_mesh]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 2
+    ny = 1
+    nz = 1
+    xmax = 2
+  []
+  [right_block]
+    type = SubdomainBoundingBoxGenerator
+    input = block_mesh
+    block_id = 1
+    bottom_left = '1 0 0'
+    top_right = '2 1 1'
+  []
+  [rename]
+    type = RenameBlockGenerator
+    input = right_block
+    old_block_id = '0 1'
+    new_block_name = 'Left_Block Right_Block'
+  []
+  [breakmesh]
+    type = BreakMeshByBlockGenerator
+    input = rename
+    interface_name = interface
+  []
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Modules/TensorMechanics/Master]
+  [all]
+    strain = SMALL
+    add_variables = true
+  []
+[]
+
+[ICs]
+  # start from an opened (or penetrated) interface, so that the effective
+  # gap at the first iterate is far from zero
+  [opening]
+    type = ConstantIC
+    variable = disp_x
+    value = ${opening}
+    block = 'Right_Block'
+  []
+[]
+
+[InterfaceKernels]
+  # the fused kernel, or one kernel per component with
+  # InterfaceKernels/active='ifk_x ifk_y ifk_z'
+  active = 'ifk'
+  [ifk]
+    type = Rczm
+    variable = disp_x
+    neighbor_var = disp_x
+    boundary = interface
+    assemble_all_components = true
+    stabilized_para = 10
+  []
+  [ifk_x]
+    type = Rczm
+    variable = disp_x
+    neighbor_var = disp_x
+    boundary = interface
+    stabilized_para = 10
+  []
+  [ifk_y]
+    type = Rczm
+    variable = disp_y
+    neighbor_var = disp_y
+    boundary = interface
+    stabilized_para = 10
+  []
+  [ifk_z]
+    type = Rczm
+    variable = disp_z
+    neighbor_var = disp_z
+    boundary = interface
+    stabilized_para = 10
+  []
+[]
+
+[Materials]
+  [Elasticity_Left]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 100
+    poissons_ratio = 0.3
+    block = 'Left_Block'
+  []
+  [Elasticity_Right]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 50
+    poissons_ratio = 0.2
+    block = 'Right_Block'
+  []
+  [stress]
+    type = ComputeLinearElasticStress
+    block = 'Left_Block Right_Block'
+  []
+  [Rigid_czm_model]
+    type = OrtizPandolfiRczm
+    boundary = 'interface'
+    # never reached as is: the interface stays intact
+    maximum_effective_traction = 1e6
+    maximum_effective_gap = 0.01
+    shear_weight = 0.707
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[Functions]
+  [ux]
+    type = ParsedFunction
+    value = '${opening} + ${rate}*t'
+  []
+  [uy]
+    type = ParsedFunction
+    value = '${fparse rate / 2}*t'
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    preset = true
+    variable = disp_x
+    value = 0
+    boundary = 'left'
+  []
+  [fix_y]
+    type = DirichletBC
+    preset = true
+    variable = disp_y
+    value = 0
+    boundary = 'left'
+  []
+  [fix_z]
+    type = DirichletBC
+    preset = true
+    variable = disp_z
+    value = 0
+    boundary = 'left'
+  []
+  [U_at_right_x]
+    type = FunctionDirichletBC
+    preset = true
+    variable = disp_x
+    function = ux
+    boundary = 'right'
+  []
+  [U_at_right_y]
+    type = FunctionDirichletBC
+    preset = true
+    variable = disp_y
+    function = uy
+    boundary = 'right'
+  []
+  [U_at_right_z]
+    type = DirichletBC
+    preset = true
+    variable = disp_z
+    value = 0
+    boundary = 'right'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 2
+  solve_type = NEWTON
+  petsc_options = '-snes_test_jacobian'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  line_search = none
+  nl_max_its = 6
+  nl_abs_tol = 1e-10
+[]
+
+[Outputs]
+  file_base = jacobian_check_out
+  exodus = true
+[]
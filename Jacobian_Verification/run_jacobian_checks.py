@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+#
+# Jacobian verification driver for jacobian_check.i.
+#
+# Runs every interface branch of Rczm/OrtizPandolfiRczm through command line
+# overrides of jacobian_check.i, parses the ||J - Jfd||_F/||J||_F ratios that
+# -snes_test_jacobian prints at every nonlinear iteration and fails (exit
+# status 1) if a case does not run, prints no ratio or exceeds the tolerance.
+#
+# Example:
+#   ./run_jacobian_checks.py --exe ../kitfox-opt
+#
+import argparse
+import re
+import subprocess
+import sys
+
+SOFTENING = ['opening=0.002',
+             'Materials/Rigid_czm_model/damage_degree_init=0.3',
+             'Materials/Rigid_czm_model/maximum_effective_traction=1']
+
+CASES = {
+    # DG branch, fused kernel
+    'intact': [],
+    # mixed-mode cohesive law on a pre-opened interface, one kernel per component
+    'softening': ["InterfaceKernels/active='ifk_x ifk_y ifk_z'"] + SOFTENING,
+    # cohesive law in its linear range below regularization_gap, fused kernel
+    'softening_regularized': SOFTENING + ['Materials/Rigid_czm_model/regularization_gap=0.004'],
+    # failed interface closed by tied contact (DG branch under failure), fused kernel
+    'tied_contact': ['InterfaceKernels/ifk/tied_contact=true',
+                     'opening=-0.001',
+                     'rate=-0.001',
+                     'Materials/Rigid_czm_model/damage_degree_init=1'],
+}
+
+# PETSc >= 3.9 (-snes_test_jacobian) and older PETSc (-snes_type test)
+RATIO = re.compile(r'\|\|J - Jfd\|\|_F/\|\|J\|\|_F = ([^\s,]+)|Norm of matrix ratio ([^\s,]+)')
+
+
+def ratios(output):
+    return [float(a or b) for a, b in RATIO.findall(output)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='interface Jacobian verification driver')
+    parser.add_argument('--exe', required=True, help='application executable')
+    parser.add_argument('--input', default='jacobian_check.i')
+    parser.add_argument('--tolerance', type=float, default=1e-6,
+                        help='largest ||J - Jfd||_F/||J||_F accepted')
+    parser.add_argument('--cases', nargs='+', choices=sorted(CASES), default=list(CASES))
+    args = parser.parse_args()
+
+    failed = []
+    for case in args.cases:
+        cmd = [args.exe, '-i', args.input,
+               'Outputs/file_base=jacobian_%s_out' % case] + CASES[case]
+        run = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                             universal_newlines=True)
+        with open('jacobian_%s.log' % case, 'w') as log:
+            log.write(run.stdout)
+        values = ratios(run.stdout)
+        if run.returncode != 0:
+            status = 'FAIL (exit status %d)' % run.returncode
+        elif not values:
+            status = 'FAIL (no Jacobian test output)'
+        elif not max(values) <= args.tolerance:
+            status = 'FAIL'
+        else:
+            status = 'OK'
+        worst = '%.3e' % max(values) if values else '-'
+        print('%-24s %-30s max ||J - Jfd||_F/||J||_F = %s over %d iterations'
+              % (case, status, worst, len(values)), flush=True)
+        if status != 'OK':
+            failed.append(case)
+
+    if failed:
+        sys.exit('failed: %s (see jacobian_<case>.log)' % ' '.join(failed))
+
+
+if __name__ == '__main__':
+    main()
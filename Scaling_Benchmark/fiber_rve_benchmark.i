@@ -0,0 +1,325 @@
+# Scaling benchmark: n x n fiber RVE under biaxial tension.
+# The mesh is generated procedurally with the Matrix/Fiber blocks and the
+# X/Y/Z_Minus/Plus boundaries that 64_Fiber_Failure/model_fiber_64_biaxis.i
+# expects. The fiber pattern has to be given for every n, e.g. for n = 2:
+#   kitfox-opt -i fiber_rve_benchmark.i n=2 "Mesh/rve/pattern='0 0;0 0'"
+# run_benchmark.py does this for every size and rank count. The solve is the
+# production one, PJFNK with an LU preconditioner; giving
+# ../64_Fiber_Failure/fieldsplit.i after this input switches it to the
+# interface/bulk field split (run_benchmark.py --preconditioner fsp).
+n = 8
+
+[Mesh]
+  # one fiber in a unit matrix cell
+  [cell]
+    type = ConcentricCircleMeshGenerator
+    num_sectors = 4
+    radii = '0.35'
+    rings = '3 2'
+    has_outer_square = true
+    pitch = 1
+    preserve_volumes = true
+    smoothing_max_it = 3
+  []
+  [rve]
+    type = PatternedMeshGenerator
+    inputs = 'cell'
+    pattern = '0 0 0 0 0 0 0 0;
+               0 0 0 0 0 0 0 0;
+               0 0 0 0 0 0 0 0;
+               0 0 0 0 0 0 0 0;
+               0 0 0 0 0 0 0 0;
+               0 0 0 0 0 0 0 0;
+               0 0 0 0 0 0 0 0;
+               0 0 0 0 0 0 0 0'
+  []
+  [extrude]
+    type = MeshExtruderGenerator
+    input = rve
+    extrusion_vector = '0 0 0.25'
+    num_layers = 1
+    bottom_sideset = 'Z_Minus'
+    top_sideset = 'Z_Plus'
+  []
+  [boundaries]
+    type = RenameBoundaryGenerator
+    input = extrude
+    old_boundary_name = 'left right bottom top'
+    new_boundary_name = 'X_Minus X_Plus Y_Minus Y_Plus'
+  []
+  [blocks]
+    type = RenameBlockGenerator
+    input = boundaries
+    old_block_id = '1 2'
+    new_block_name = 'Fiber Matrix'
+  []
+  # both sides of the interface, for the field split of fieldsplit.i
+  [matrix_side]
+    type = SideSetsBetweenSubdomainsGenerator
+    input = blocks
+    primary_block = 'Matrix'
+    paired_block = 'Fiber'
+    new_boundary = 'matrix_side'
+  []
+  [fiber_side]
+    type = SideSetsBetweenSubdomainsGenerator
+    input = matrix_side
+    primary_block = 'Fiber'
+    paired_block = 'Matrix'
+    new_boundary = 'fiber_side'
+  []
+  [breakmesh]
+    type = BreakMeshByBlockGenerator
+    input = fiber_side
+    interface_name = matrix_fiber
+  []
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Modules/TensorMechanics/Master]
+  [all]
+    strain = FINITE
+    add_variables = true
+    extra_vector_tags = react
+  []
+[]
+
+[InterfaceKernels]
+  [ifk]
+    type = Rczm
+    variable = 'disp_x'
+    neighbor_var = 'disp_x'
+    assemble_all_components = true
+    block_constant_modulus = true
+    boundary = 'matrix_fiber'
+    stabilized_para = 2
+    time_assembly = true
+  []
+[]
+
+[Materials]
+  [Elasticity_Matrix]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 0.003
+    poissons_ratio = 0.3
+    block = 'Matrix'
+  []
+  [Elasticity_Fiber]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 0.072
+    poissons_ratio = 0.21
+    block = 'Fiber'
+  []
+  [stress]
+    type = ComputeFiniteStrainElasticStress
+    block = 'Matrix Fiber'
+  []
+  [Rigid_czm_model]
+    type = OrtizPandolfiRczm
+    boundary = 'matrix_fiber'
+    maximum_effective_traction = 8e-6
+    maximum_effective_gap = 0.01
+    shear_weight = 0.707
+    time_cohesive_law = true
+  []
+[]
+
+[Functions]
+  # same nominal strain for every n: 5e-4 per step, i.e. 0.01 after the 20
+  # steps. The radial interface traction reaches maximum_effective_traction
+  # after a few steps, so that most of the run assembles softening and
+  # failed interface qps and not only the DG branch.
+  [topfunc]
+    type = ParsedFunction
+    value = '${fparse 0.1 * n}*t'
+  []
+[]
+
+[BCs]
+  [roller_at_X_minus]
+    type = DirichletBC
+    preset = true
+    variable = disp_x
+    value = 0
+    boundary = 'X_Minus'
+  []
+  [roller_at_Y_minus]
+    type = DirichletBC
+    preset = true
+    variable = disp_y
+    value = 0
+    boundary = 'Y_Minus'
+  []
+  [roller_at_Z_minus]
+    type = DirichletBC
+    preset = true
+    variable = disp_z
+    value = 0
+    boundary = 'Z_Minus'
+  []
+  [roller_at_Z_plus]
+    type = DirichletBC
+    preset = true
+    variable = disp_z
+    value = 0
+    boundary = 'Z_Plus'
+  []
+  [U_at_X_plus]
+    type = FunctionDirichletBC
+    variable = disp_x
+    function = topfunc
+    preset = true
+    boundary = 'X_Plus'
+  []
+  [U_at_Y_plus]
+    type = FunctionDirichletBC
+    variable = disp_y
+    function = topfunc
+    preset = true
+    boundary = 'Y_Plus'
+  []
+[]
+
+[AuxVariables]
+  [RF_X]
+    order = FIRST
+  []
+[]
+
+[AuxKernels]
+  [RF_X]
+    type = TagVectorAux
+    variable = RF_X
+    v = disp_x
+    vector_tag = react
+  []
+[]
+
+[Postprocessors]
+  [Reaction_Force_Along_X]
+    type = NodalSum
+    boundary = X_Plus
+    variable = RF_X
+  []
+  # cumulative wall time (s) of assembly and solve
+  [Residual_Time]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeResidualInternal'
+    data_type = TOTAL
+    must_exist = true
+  []
+  [Jacobian_Time]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeJacobianInternal'
+    data_type = TOTAL
+    must_exist = true
+  []
+  [Interface_Residual_Time]
+    type = InterfaceAssemblyTime
+    object = ifk
+    section = residual
+  []
+  [Interface_Jacobian_Time]
+    type = InterfaceAssemblyTime
+    object = ifk
+    section = jacobian
+  []
+  [Cohesive_Law_Time]
+    type = InterfaceAssemblyTime
+    object = Rigid_czm_model
+    section = cohesive_law
+  []
+  [Solve_Time]
+    type = PerfGraphData
+    section_name = 'FEProblem::solve'
+    data_type = TOTAL
+    must_exist = true
+  []
+  # peak memory (MiB) of the largest rank
+  [Memory]
+    type = MemoryUsage
+    mem_type = physical_memory
+    value_type = max_process
+  []
+  [NL_Its]
+    type = NumNonlinearIterations
+  []
+  [L_Its]
+    type = NumLinearIterations
+  []
+  [Total_NL_Its]
+    type = CumulativeValuePostprocessor
+    postprocessor = NL_Its
+  []
+  [Total_L_Its]
+    type = CumulativeValuePostprocessor
+    postprocessor = L_Its
+  []
+  # interface qps per state at the end of the step and per branch assembled
+  # in the last residual evaluation; the time splits above depend on them
+  [Intact_Interface_Qps]
+    type = InterfaceStateCount
+    boundary = 'matrix_fiber'
+    state = intact
+  []
+  [Softening_Interface_Qps]
+    type = InterfaceStateCount
+    boundary = 'matrix_fiber'
+    state = softening
+  []
+  [Failed_Open_Interface_Qps]
+    type = InterfaceStateCount
+    boundary = 'matrix_fiber'
+    state = failed_open
+  []
+  [Failed_Contact_Interface_Qps]
+    type = InterfaceStateCount
+    boundary = 'matrix_fiber'
+    state = failed_contact
+  []
+  [Cohesive_Branch_Qps]
+    type = InterfaceBranchCount
+    interface_kernel = ifk
+    branch = cohesive_softening
+  []
+  [Failed_Branch_Qps]
+    type = InterfaceBranchCount
+    interface_kernel = ifk
+    branch = failed
+  []
+[]
+
+[Problem]
+  extra_tag_vectors = react
+[]
+
+[Preconditioning]
+  [pc]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  # fixed number of steps so that runs are comparable
+  dt = 0.005
+  num_steps = 20
+  petsc_options_iname = '-pc_type -pc_factor_mat_solver_package'
+  petsc_options_value = 'lu       superlu_dist'
+  solve_type = PJFNK
+  line_search = none
+  l_max_its = 30
+  nl_max_its = 15
+  nl_abs_tol = 1e-8
+[]
+
+[Outputs]
+  file_base = fiber_rve_benchmark_out
+  [csv]
+    type = CSV
+  []
+[]
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+#
+# Scaling benchmark driver for fiber_rve_benchmark.i.
+#
+# Runs the n x n fiber RVE for every requested fiber count on 1..P MPI ranks
+# (powers of two) for a fixed number of steps and collects assembly time,
+# solve time, peak memory, nonlinear/linear iteration counts and the number of
+# intact/softening/failed interface qps from the postprocessors of the last
+# time step into one summary CSV. --preconditioner fsp replaces the LU
+# preconditioner by the interface/bulk field split of
+# 64_Fiber_Failure/fieldsplit.i.
+#
+# Example:
+#   ./run_benchmark.py --exe ../kitfox-opt --fibers 1 16 64 --max-ranks 4
+#   ./run_benchmark.py --exe ../kitfox-opt --fibers 64 --preconditioner fsp
+#
+import argparse
+import csv
+import math
+import os
+import subprocess
+import sys
+
+FIELDSPLIT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir,
+                          '64_Fiber_Failure', 'fieldsplit.i')
+COLUMNS = ['Residual_Time', 'Jacobian_Time', 'Interface_Residual_Time',
+           'Interface_Jacobian_Time', 'Cohesive_Law_Time', 'Solve_Time', 'Memory',
+           'Total_NL_Its', 'Total_L_Its', 'Intact_Interface_Qps',
+           'Softening_Interface_Qps', 'Failed_Open_Interface_Qps',
+           'Failed_Contact_Interface_Qps', 'Cohesive_Branch_Qps', 'Failed_Branch_Qps']
+
+
+def pattern(n):
+    """PatternedMeshGenerator pattern of an n x n array of identical cells."""
+    return ';'.join([' '.join(['0'] * n)] * n)
+
+
+def ranks(max_ranks):
+    """1, 2, 4, ... up to and including max_ranks."""
+    r = [1]
+    while r[-1] * 2 <= max_ranks:
+        r.append(r[-1] * 2)
+    if r[-1] != max_ranks:
+        r.append(max_ranks)
+    return r
+
+
+def last_row(csv_file):
+    with open(csv_file) as f:
+        rows = list(csv.DictReader(f))
+    return rows[-1] if rows else {}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='fiber RVE scaling benchmark driver')
+    parser.add_argument('--exe', required=True, help='application executable')
+    parser.add_argument('--input', default='fiber_rve_benchmark.i')
+    parser.add_argument('--fibers', type=int, nargs='+', default=[1, 16, 64, 256, 1024],
+                        help='fiber counts; each must be a perfect square')
+    parser.add_argument('--max-ranks', type=int, default=1)
+    parser.add_argument('--steps', type=int, default=20,
+                        help='time steps; the first few stay below cohesive onset')
+    parser.add_argument('--preconditioner', choices=['lu', 'fsp'], default='lu',
+                        help='LU (as in production) or the field split of fieldsplit.i')
+    parser.add_argument('--mpiexec', default='mpiexec')
+    parser.add_argument('--output', default='benchmark_summary.csv')
+    parser.add_argument('extra', nargs='*', help='extra command line arguments for the input')
+    args = parser.parse_args()
+    inputs = [args.input] + ([FIELDSPLIT] if args.preconditioner == 'fsp' else [])
+
+    summary = []
+    for fibers in args.fibers:
+        n = int(round(math.sqrt(fibers)))
+        if n * n != fibers:
+            sys.exit('fiber count %d is not a perfect square' % fibers)
+        for np in ranks(args.max_ranks):
+            file_base = 'fiber_rve_%d_np%d_%s' % (fibers, np, args.preconditioner)
+            cmd = [args.mpiexec, '-n', str(np), args.exe, '-i'] + inputs + [
+                   'n=%d' % n,
+                   "Mesh/rve/pattern='%s'" % pattern(n),
+                   'Executioner/num_steps=%d' % args.steps,
+                   'Outputs/file_base=%s' % file_base] + args.extra
+            print('fibers = %d, ranks = %d, preconditioner = %s'
+                  % (fibers, np, args.preconditioner), flush=True)
+            with open(file_base + '.log', 'w') as log:
+                status = subprocess.call(cmd, stdout=log, stderr=subprocess.STDOUT)
+            row = {'fibers': fibers, 'ranks': np, 'preconditioner': args.preconditioner,
+                   'status': status}
+            csv_file = file_base + '.csv'
+            if os.path.exists(csv_file):
+                values = last_row(csv_file)
+                row.update({c: values.get(c, '') for c in COLUMNS})
+            summary.append(row)
+
+    with open(args.output, 'w', newline='') as f:
+        writer = csv.DictWriter(f, fieldnames=['fibers', 'ranks', 'preconditioner', 'status']
+                                + COLUMNS)
+        writer.writeheader()
+        writer.writerows(summary)
+    print('summary written to %s' % args.output)
+
+
+if __name__ == '__main__':
+    main()
@@ -10,6 +10,8 @@
 #pragma once
 #include "InterfaceKernel.h"
 #include "JvarMapInterface.h"
+#include "BlockPairModulusCache.h"
+#include "IntervalTimer.h"
 //c
 //c An interface shared by two elements may tie two elements together, open, close,
 //c slide, and form an aperture within which fuilds may flow due to material failure.
@@ -21,6 +23,12 @@ class DGSolid: public JvarMapKernelInterface<InterfaceKernel>
 public:
   static InputParameters validParams();
   DGSolid(const InputParameters & parameters);
+  //c
+  //c wall time (s) this copy spent in the face-level residual and Jacobian assembly;
+  //c zero unless time_assembly is set
+  //c
+  Real residualTime() const { return _residual_timer.seconds(); }
+  Real jacobianTime() const { return _jacobian_timer.seconds(); }
 protected:
   //c
   //c  stabilized parameter (/lambda)
@@ -33,6 +41,46 @@ protected:
   virtual Real computeQpJacobian(Moose::DGJacobianType type) override;
   virtual Real computeQpOffDiagJacobian(Moose::DGJacobianType type, unsigned int jvar) override;
   //c
+  //c face-level assembly: hoist the per-qp quantities and, if requested, assemble all
+  //c displacement components and their coupled blocks in one pass over the face.
+  //c
+  virtual void computeElemNeighResidual(Moose::DGResidualType type) override;
+  virtual void computeElemNeighJacobian(Moose::DGJacobianType type) override;
+  virtual void computeOffDiagElemNeighJacobian(Moose::DGJacobianType type,
+                                               unsigned int jvar) override;
+  //c
+  //c the per-qp quantities only change between residual/Jacobian evaluations: forget the
+  //c current face at the start of every evaluation (see reinitFace)
+  //c
+  virtual void initialSetup() override;
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+  //c
+  //c prepare the current face once per evaluation: decide if it is inactive and fill the
+  //c per-qp quantities, including the residual-only ones if need_residual is true
+  //c
+  void reinitFace(bool need_residual);
+  //c
+  //c per-qp quantities used by both the residual and the Jacobian (DG penalty)
+  //c
+  virtual void precomputeQpQuantities();
+  //c
+  //c per-qp quantities used by the residual only (average traction, jump)
+  //c
+  virtual void precomputeQpResidualQuantities();
+  //c
+  //c true if the whole face contributes nothing and its assembly can be skipped
+  //c
+  virtual bool isInactiveFace() { return false; }
+  //c
+  //c residual of displacement component "component" and its derivative with respect to
+  //c displacement component "coupled_component" at the current (_qp, _i, _j)
+  //c
+  virtual Real computeQpResidualComponent(Moose::DGResidualType type, unsigned int component);
+  virtual Real computeQpJacobianComponents(Moose::DGJacobianType type,
+                                           unsigned int component,
+                                           unsigned int coupled_component);
+  //c
   //c the displacement component this kernel is operating on (0=x, 1=y, 2 =z)
   //c
    //const unsigned int _component;
@@ -55,4 +103,32 @@ protected:
   const MaterialProperty<RankFourTensor> & _elasticity_tensor_neighbor;
   const MaterialProperty<RankFourTensor> & _tangent_modulus;
   const MaterialProperty<RankFourTensor> & _tangent_modulus_neighbor;
+  //c
+  //c if true, this single kernel assembles all _ndisp components
+  //c
+  const bool _assemble_all_components;
+  //c
+  //c per-qp quantities hoisted out of the (_i, _j) loops
+  //c
+  std::vector<RealVectorValue> _qp_average_traction;
+  std::vector<RealVectorValue> _qp_displacement_jump;
+  std::vector<Real> _qp_DG_para;
+  //c
+  //c (element id, side) of the face the per-qp quantities belong to
+  //c
+  std::pair<dof_id_type, unsigned int> _face;
+  bool _face_inactive;
+  bool _face_residual_ready;
+  //c
+  //c elasticity tensors are constant per block: take the shear modulus from a
+  //c per-subdomain-pair table instead of the RankFourTensors at every qp
+  //c
+  const bool _block_constant_modulus;
+  BlockPairModulusCache _shear_modulus_cache;
+  //c
+  //c timers of the face-level residual and Jacobian assembly, opt-in (time_assembly)
+  //c
+  const bool _time_assembly;
+  IntervalTimer _residual_timer;
+  IntervalTimer _jacobian_timer;
 };
@@ -10,6 +10,9 @@
 #pragma once
 
 #include "DGSolid.h"
+#include "RigidBase.h"
+
+#include <array>
 
 //c This kernel implements crack propagation governed by rigid/extrinsic cohesive law (Rczm)
 //c through applying Discontinous Galerkin (DG) method: before softening,
@@ -20,11 +23,47 @@ class Rczm : public DGSolid
 public:
   static InputParameters validParams();
   Rczm(const InputParameters & parameters);
+  //c
+  //c interface branch taken at a quadrature point
+  //c
+  enum class QpBranch
+  {
+    DG,
+    COHESIVE,
+    INACTIVE,
+    TIED_CONTACT
+  };
+  //c
+  //c number of interface qps this copy assembled in a branch during the last residual
+  //c evaluation (see InterfaceBranchCount)
+  //c
+  unsigned long int branchCount(QpBranch branch) const
+  {
+    return _branch_count[static_cast<unsigned int>(branch)];
+  }
 
 protected:
-  virtual Real computeQpResidual(Moose::DGResidualType type);
-  virtual Real computeQpJacobian(Moose::DGJacobianType type);
-  virtual Real computeQpOffDiagJacobian(Moose::DGJacobianType type, unsigned int jvar);
+  //c
+  //c count the branches of every face in the residual evaluation
+  //c
+  virtual void residualSetup() override;
+  virtual void computeElemNeighResidual(Moose::DGResidualType type) override;
+  //c
+  //c branch for the state the solve starts from and the current normal gap
+  //c
+  static QpBranch computeBranch(unsigned int state_old, Real gap, bool tied_contact);
+  virtual void precomputeQpQuantities() override;
+  virtual bool isInactiveFace() override;
+  virtual Real computeQpResidualComponent(Moose::DGResidualType type,
+                                          unsigned int component) override;
+  virtual Real computeQpJacobianComponents(Moose::DGJacobianType type,
+                                           unsigned int component,
+                                           unsigned int coupled_component) override;
+  QpBranch computeQpBranch();
+  //c
+  //c state at qp the current solve starts from (active_interface_state of RigidBase)
+  //c
+  unsigned int stateOld(unsigned int qp) const { return _active_interface_state[qp]; }
   //c
   //c define traction and tangent modulus variables on interfaces
   //c
@@ -35,7 +74,18 @@ protected:
   //c material softening flag
   //c
   const MaterialProperty<bool> & _material_softening;
-  const MaterialProperty<bool> & _material_softening_old;
-  const MaterialProperty<Real> & _dmg_degree_old;
+  //c
+  //c interface state index the current solve starts from (see InterfaceState); the
+  //c material applies its state_record, if any
+  //c
+  const MaterialProperty<unsigned int> & _active_interface_state;
   const bool _tied_contact;
+  //c
+  //c per-qp branch, decided once per face
+  //c
+  std::vector<QpBranch> _qp_branch;
+  //c
+  //c qps per branch (indexed by QpBranch) in the current residual evaluation
+  //c
+  std::array<unsigned long int, 4> _branch_count;
 };
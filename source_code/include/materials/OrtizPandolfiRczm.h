@@ -21,29 +21,56 @@ public:
   static InputParameters validParams();
   OrtizPandolfiRczm(const InputParameters & parameters);
 protected:
-  virtual RealVectorValue compute_normal_plain();
-  virtual Real compute_u_n();
-  virtual Real compute_u_t();
+  //c
+  //c evaluate the kinematics and the cohesive law over all qps of the face at once
+  //c
+  virtual void computeProperties() override;
+  virtual void computeQpProperties() override;
+  void computeBatch(unsigned int begin, unsigned int end);
+  //c
+  //c compile-time specialized batch kernels (see OrtizPandolfiLaw): mixed_mode = false
+  //c is the pure mode-I law (shear_weight = 0), mixed_mode = true the general mixed law
+  //c
+  template <bool mixed_mode>
+  void computeKinematicsBatch(unsigned int begin, unsigned int end);
+  template <bool mixed_mode>
+  void computeCohesiveLawBatch(unsigned int begin, unsigned int end);
   virtual bool computeSoftening() override;
   virtual Real computeDamage() override;
-  virtual RealVectorValue computeTangentVector();
   virtual RealVectorValue computeTraction() override;
   virtual RealTensorValue computeTractionDerivatives() override;
   virtual void initQpStatefulProperties() override;
-  virtual Real compute_elastic_modulus();
-  virtual Real computeEffectiveTraction();
   virtual Real computeEffectiveGap();
   virtual Real computeTn();
   virtual Real compute_equivalent_traction();
-  virtual RealVectorValue computeEffectiveGapDerivative();
   ///c input material parameters
   const Real _T_max; //maximum effective traction materials can sustain;
   const Real _delta_max; //effective traction goes down to zero at this point;
+  const Real _delta_reg; //the traction is linear in the jump below this effective gap;
   const Real _shear_weight; //shear contribution to failure or softening.
+  const bool _mode_I; //shear_weight = 0: pure mode-I law
   /// Initial aperture/interface damage degree
   const VariableValue & _dmg_init;
   const MaterialProperty<RankTwoTensor> & _stress;
   const MaterialProperty<RankTwoTensor> & _stress_neighbor;
-  const MaterialProperty<RankFourTensor> & _elasticity_tensor;
-  const MaterialProperty<RankFourTensor> & _elasticity_tensor_neighbor;
+  ///c T_eq/T_max of an intact interface in tension (0 otherwise); reaches 1 at onset
+  MaterialProperty<Real> & _onset_ratio;
+  ///c structure-of-arrays kinematics of the current face, computed once per qp
+  struct CohesiveKinematics
+  {
+    void resize(unsigned int n_qp);
+    std::vector<Real> jump[3];
+    std::vector<Real> normal[3];
+    std::vector<Real> u_t_vector[3];
+    std::vector<Real> u_n;
+    std::vector<Real> u_t;
+    std::vector<Real> delta_effective;
+  } _kinematics;
+  ///c structure-of-arrays cohesive law results of the current face
+  struct CohesiveResponse
+  {
+    void resize(unsigned int n_qp);
+    std::vector<Real> traction[3];
+    std::vector<Real> tangent[3][3];
+  } _response;
 };
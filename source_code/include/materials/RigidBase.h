@@ -10,6 +10,20 @@
 #pragma once
 
 #include "InterfaceMaterial.h"
+#include "IntervalTimer.h"
+
+class InterfaceStateRecord;
+//c
+//c state index of an interface quadrature point. Stored as a stateful material property
+//c so that the old value describes the state at the end of the last time step.
+//c
+enum class InterfaceState : unsigned int
+{
+  INTACT = 0,
+  SOFTENING,
+  FAILED_OPEN,
+  FAILED_CONTACT
+};
 //c
 //c This is the base Material class for implementing a rigid traction separation material model.
 //c
@@ -18,9 +32,24 @@ class RigidBase: public InterfaceMaterial
 public:
   static InputParameters validParams();
   RigidBase(const InputParameters & parameters);
+  //c
+  //c wall time (s) this copy spent in the cohesive law; zero unless time_cohesive_law is set
+  //c
+  Real cohesiveLawTime() const { return _cohesive_law_timer.seconds(); }
 
 protected:
+  //c
+  //c times the cohesive law of the whole face
+  //c
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
+  //c
+  //c the timer a face evaluation adds to, or null if timing is off
+  //c
+  IntervalTimer * cohesiveLawTimer()
+  {
+    return _time_cohesive_law ? &_cohesive_law_timer : nullptr;
+  }
 
   //c normal to the interface
   const MooseArray<Point> & _normals;
@@ -41,6 +70,24 @@ protected:
   virtual RealTensorValue computeTractionDerivatives() = 0;
 
   virtual RealTensorValue computeThreeOrthoVector(RealVectorValue n_vector);
+
+  //c method returning the state index from the current softening flag, damage and gap.
+  virtual InterfaceState computeInterfaceState();
+
+  //c state the current solve starts from: the state at the end of the last time step,
+  //c promoted by earlier solves of this step when a state_record is given. Stored in
+  //c active_interface_state at the current qp.
+  void computeActiveState();
+
+  //c the active state at the current qp (computeActiveState must have run).
+  unsigned int stateOld() const;
+
+  //c true if the interface had started softening before the current solve.
+  bool softenedOld() const;
+
+  //c true if the interface had fully failed before the current solve; the
+  //c cohesive law is not evaluated there any more.
+  bool failedOld() const;
   //c
   //c the displacement jump in global
   //c
@@ -71,4 +118,23 @@ protected:
   //c
   MaterialProperty<Real> & _dmg_degree;
   const MaterialProperty<Real> & _dmg_degree_old;
+  //c
+  //c interface state index (see InterfaceState)
+  //c
+  MaterialProperty<unsigned int> & _interface_state;
+  const MaterialProperty<unsigned int> & _interface_state_old;
+  //c
+  //c state the current solve starts from, published so that Rczm and the interface
+  //c postprocessors follow the same state_record as the material
+  //c
+  MaterialProperty<unsigned int> & _active_interface_state;
+  //c
+  //c optional record of the state reached within the current time step
+  //c
+  const InterfaceStateRecord * const _state_record;
+  //c
+  //c timer of the cohesive law evaluation, opt-in (time_cohesive_law)
+  //c
+  const bool _time_cohesive_law;
+  IntervalTimer _cohesive_law_timer;
 };
@@ -0,0 +1,48 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class DGSolid;
+class RigidBase;
+//c
+//c Cumulative wall time (s) of the face-level residual or Jacobian assembly of a DGSolid/Rczm
+//c kernel (time_assembly = true), or of the cohesive law of a RigidBase material
+//c (time_cohesive_law = true). Summed over the threads of a process; the largest process
+//c total is reported.
+//c
+class InterfaceAssemblyTime : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+  InterfaceAssemblyTime(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+
+protected:
+  //c
+  //c the timed section and the (per-thread) copies of the timed object
+  //c
+  enum class Section
+  {
+    RESIDUAL,
+    JACOBIAN,
+    COHESIVE_LAW
+  };
+  const Section _section;
+  std::vector<const DGSolid *> _kernels;
+  std::vector<const RigidBase *> _materials;
+  Real _time;
+};
@@ -0,0 +1,39 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class Rczm;
+//c
+//c Number of interface quadrature points an Rczm kernel assembled in one branch
+//c (dg_intact / cohesive_softening / failed / tied_contact) during its last residual
+//c evaluation. The kernel counts the branches it actually took; nothing is re-derived here.
+//c
+class InterfaceBranchCount : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+  InterfaceBranchCount(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+
+protected:
+  //c
+  //c the branch being counted and the (per-thread) copies of the kernel
+  //c
+  const unsigned int _branch;
+  std::vector<const Rczm *> _kernels;
+  unsigned long int _count;
+};
@@ -0,0 +1,56 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "InterfacePostprocessor.h"
+
+//c
+//c Reduction over the interface of the quantities that govern crack onset and growth:
+//c the largest T_eq/T_max of the intact interface, the largest damage increment of the
+//c step, the number of quadrature points that started softening during the step, or the
+//c number promoted (intact -> softening -> failed) by the last solve alone, i.e. beyond
+//c the state recorded by the earlier fixed-point iterations of the step.
+//c
+class InterfaceDamageMonitor : public InterfacePostprocessor
+{
+public:
+  static InputParameters validParams();
+  InterfaceDamageMonitor(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+
+protected:
+  //c
+  //c the reduced quantity
+  //c
+  enum class Quantity
+  {
+    MAX_ONSET_RATIO,
+    MAX_DAMAGE_INCREMENT,
+    NEWLY_SOFTENED,
+    NEWLY_PROMOTED
+  };
+  const Quantity _quantity;
+  const MaterialProperty<Real> & _onset_ratio;
+  const MaterialProperty<Real> & _dmg_degree;
+  const MaterialProperty<Real> & _dmg_degree_old;
+  const MaterialProperty<unsigned int> & _interface_state;
+  const MaterialProperty<unsigned int> & _interface_state_old;
+  //c
+  //c state the last solve started from, i.e. promoted by the state_record of the
+  //c material (newly_promoted only)
+  //c
+  const MaterialProperty<unsigned int> & _active_interface_state;
+  Real _value;
+};
@@ -0,0 +1,36 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "InterfacePostprocessor.h"
+//c
+//c Counts the interface quadrature points in one state of the interface state index
+//c (intact / softening / failed_open / failed_contact) declared by RigidBase materials.
+//c
+class InterfaceStateCount : public InterfacePostprocessor
+{
+public:
+  static InputParameters validParams();
+  InterfaceStateCount(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual Real getValue() override;
+
+protected:
+  //c
+  //c interface state index and the state being counted
+  //c
+  const MaterialProperty<unsigned int> & _interface_state;
+  const unsigned int _state;
+  unsigned long int _count;
+};
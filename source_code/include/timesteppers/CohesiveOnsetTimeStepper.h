@@ -0,0 +1,60 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "TimeStepper.h"
+//c
+//c Time stepper driven by the cohesive interface: grows dt while the interface is far from
+//c onset, shrinks it as the largest T_eq/T_max approaches one, and caps the damage
+//c increment per step once the interface softens (see InterfaceDamageMonitor): a step
+//c exceeding the cap is rejected and repeated with a shorter step.
+//c
+class CohesiveOnsetTimeStepper : public TimeStepper
+{
+public:
+  static InputParameters validParams();
+  CohesiveOnsetTimeStepper(const InputParameters & parameters);
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+  virtual Real computeFailedDT() override;
+  virtual void step() override;
+  virtual bool converged() const override;
+  //c
+  //c initial time step and growth limit
+  //c
+  const Real _dt_initial;
+  const Real _growth_factor;
+  //c
+  //c fraction of the remaining distance to onset a step may cover, and the smallest
+  //c onset-ratio increase allowed per step (the step that crosses onset)
+  //c
+  const Real _onset_fraction;
+  const Real _onset_tolerance;
+  //c
+  //c largest damage increment allowed per step
+  //c
+  const Real _max_damage_increment;
+  //c
+  //c interface monitors
+  //c
+  const PostprocessorValue & _onset_ratio;
+  const PostprocessorValue & _damage_increment;
+  const PostprocessorValue & _newly_softened;
+  //c
+  //c onset ratio of the previous converged step
+  //c
+  Real & _onset_ratio_old;
+  //c
+  //c damage increment of the last step if it was rejected for exceeding the cap, else zero
+  //c
+  Real _rejected_damage_increment;
+};
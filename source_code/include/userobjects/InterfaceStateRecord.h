@@ -0,0 +1,55 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "InterfaceUserObject.h"
+//c
+//c Records the interface state index reached by the last solve of the current time step.
+//c Executed on TIMESTEP_END, i.e. after every fixed-point iteration of the step, it lets
+//c a RigidBase material (given as its state_record) apply the softening found by the
+//c previous solve when the step is solved again, so that a crack may advance several qp
+//c layers per time step. Rczm follows through the material's active_interface_state.
+//c
+class InterfaceStateRecord : public InterfaceUserObject
+{
+public:
+  static InputParameters validParams();
+  InterfaceStateRecord(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  //c
+  //c state to start the current solve from: the state at the end of the last time step,
+  //c promoted by the state recorded during earlier solves of the current time step
+  //c
+  unsigned int activeState(const Elem * elem,
+                           unsigned int side,
+                           unsigned int qp,
+                           unsigned int state_old) const;
+
+protected:
+  const MaterialProperty<unsigned int> & _interface_state;
+  //c
+  //c (element id, side) -> state at each qp of the faces that are no longer intact
+  //c
+  typedef std::map<std::pair<dof_id_type, unsigned int>, std::vector<unsigned int>> StateMap;
+  StateMap _pending;
+  StateMap _record;
+  //c
+  //c time at which _record was taken; records of other (e.g. cut back) steps are ignored
+  //c
+  Real _record_time;
+  //c
+  //c the thread 0 copy, which holds the finalized record
+  //c
+  const InterfaceStateRecord * const _primary;
+};
@@ -0,0 +1,42 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <map>
+#include <utility>
+//c
+//c Table of scalar moduli (e.g. the DG shear-like modulus) keyed by the (element, neighbor)
+//c subdomain pair of an interface face. With elasticity tensors that are constant within
+//c each block, the value is extracted from the RankFourTensors once per block pair instead
+//c of at every interface qp. The values are never invalidated: the owner must not use the
+//c table for stateful (i.e. varying) elasticity tensors.
+//c Every interface kernel keeps its own (thread-local) copy.
+//c
+class BlockPairModulusCache
+{
+public:
+  //c
+  //c return the cached value for the pair, computing it with "compute" on a miss
+  //c
+  template <typename Compute>
+  Real get(SubdomainID elem_subdomain, SubdomainID neighbor_subdomain, Compute && compute)
+  {
+    const auto key = std::make_pair(elem_subdomain, neighbor_subdomain);
+    auto it = _table.find(key);
+    if (it == _table.end())
+      it = _table.emplace(key, compute()).first;
+    return it->second;
+  }
+
+private:
+  std::map<std::pair<SubdomainID, SubdomainID>, Real> _table;
+};
@@ -0,0 +1,54 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <chrono>
+//c
+//c Accumulated wall time of a code section run by kernels or materials, i.e. inside the
+//c threaded assembly loops where PerfGraph sections cannot be used. Every object keeps
+//c its own (thread-local) timer; InterfaceAssemblyTime reports the totals.
+//c
+class IntervalTimer
+{
+public:
+  IntervalTimer() : _total(std::chrono::steady_clock::duration::zero()) {}
+  //c
+  //c adds its own lifetime to the timer; a null timer makes it a no-op
+  //c
+  class Guard
+  {
+  public:
+    Guard(IntervalTimer * timer) : _timer(timer)
+    {
+      if (_timer)
+        _start = std::chrono::steady_clock::now();
+    }
+    ~Guard()
+    {
+      if (_timer)
+        _timer->_total += std::chrono::steady_clock::now() - _start;
+    }
+    Guard(const Guard &) = delete;
+    Guard & operator=(const Guard &) = delete;
+
+  private:
+    IntervalTimer * const _timer;
+    std::chrono::steady_clock::time_point _start;
+  };
+  //c
+  //c total time in seconds
+  //c
+  Real seconds() const { return std::chrono::duration<Real>(_total).count(); }
+
+private:
+  std::chrono::steady_clock::duration _total;
+};
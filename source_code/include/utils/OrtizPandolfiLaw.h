@@ -0,0 +1,271 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <cmath>
+//c
+//c Batched kinematics and traction/tangent of the rigid Ortiz-Pandolfi cohesive law over
+//c the quadrature points [begin, end) of an interface face, stored as structure of arrays.
+//c Plain arrays and no MOOSE types, so that OrtizPandolfiRczm and the stand-alone
+//c Cohesive_Law_Benchmark share the same code. mixed_mode = false is the pure mode-I law
+//c (shear_weight = 0), mixed_mode = true the general mixed law.
+//c
+//c The per-qp loops run over __restrict arrays without control flow, so that they
+//c vectorize at -O3, and at -O2 in OpenMP builds through the omp simd hint. std::sqrt
+//c sets errno unless -fno-math-errno is given and keeps a loop scalar: the square roots
+//c of the kinematics are taken in a separate short loop. Cohesive_Law_Benchmark checks
+//c this with -fopt-info-vec.
+//c
+#ifdef _OPENMP
+#define ORTIZ_PANDOLFI_LAW_SIMD _Pragma("omp simd")
+#else
+#define ORTIZ_PANDOLFI_LAW_SIMD
+#endif
+
+namespace OrtizPandolfiLaw
+{
+//c
+//c the qp loops proper: one flat __restrict array per component, so that the compiler
+//c needs no run-time alias checks
+//c
+namespace detail
+{
+template <bool mixed_mode, typename T>
+void
+computeKinematics(unsigned int begin,
+                  unsigned int end,
+                  const T * __restrict jump_x,
+                  const T * __restrict jump_y,
+                  const T * __restrict jump_z,
+                  const T * __restrict normal_x,
+                  const T * __restrict normal_y,
+                  const T * __restrict normal_z,
+                  T w2,
+                  T * __restrict u_t_x,
+                  T * __restrict u_t_y,
+                  T * __restrict u_t_z,
+                  T * __restrict un,
+                  T * __restrict ut2,
+                  T * __restrict delta2)
+{
+  ORTIZ_PANDOLFI_LAW_SIMD
+  for (unsigned int q = begin; q < end; q++)
+  {
+    const T u_n = jump_x[q] * normal_x[q] + jump_y[q] * normal_y[q] + jump_z[q] * normal_z[q];
+    un[q] = u_n;
+    if (mixed_mode)
+    {
+      const T tx = jump_x[q] - u_n * normal_x[q];
+      const T ty = jump_y[q] - u_n * normal_y[q];
+      const T tz = jump_z[q] - u_n * normal_z[q];
+      u_t_x[q] = tx;
+      u_t_y[q] = ty;
+      u_t_z[q] = tz;
+      ut2[q] = tx * tx + ty * ty + tz * tz;
+      delta2[q] = u_n * u_n + w2 * ut2[q];
+    }
+    else
+      delta2[q] = u_n * u_n;
+  }
+}
+
+template <bool mixed_mode, typename T>
+void
+computeCohesiveLaw(unsigned int begin,
+                   unsigned int end,
+                   const T * __restrict jump_x,
+                   const T * __restrict jump_y,
+                   const T * __restrict jump_z,
+                   const T * __restrict normal_x,
+                   const T * __restrict normal_y,
+                   const T * __restrict normal_z,
+                   const T * __restrict u_t_x,
+                   const T * __restrict u_t_y,
+                   const T * __restrict u_t_z,
+                   const T * __restrict un,
+                   const T * __restrict delta,
+                   T T_max,
+                   T delta_max,
+                   T delta_reg,
+                   T w2,
+                   T * __restrict traction_x,
+                   T * __restrict traction_y,
+                   T * __restrict traction_z,
+                   T * __restrict k00,
+                   T * __restrict k01,
+                   T * __restrict k02,
+                   T * __restrict k10,
+                   T * __restrict k11,
+                   T * __restrict k12,
+                   T * __restrict k20,
+                   T * __restrict k21,
+                   T * __restrict k22)
+{
+  ORTIZ_PANDOLFI_LAW_SIMD
+  for (unsigned int q = begin; q < end; q++)
+  {
+    //c
+    //c below delta_reg the law is linear: evaluate it at delta_reg. Traction and tangent
+    //c vanish once delta_eff reaches delta_max.
+    //c
+    const T delta_q = delta[q];
+    const T delta_c = delta_q > delta_reg ? delta_q : delta_reg;
+    const T softening = T_max * (1.0 - delta_c / delta_max);
+    const T T_effective = softening > 0.0 ? softening : T(0.0);
+    const T inv_delta = 1.0 / delta_c;
+    const T nx = normal_x[q];
+    const T ny = normal_y[q];
+    const T nz = normal_z[q];
+    const T u_n = un[q];
+    //c
+    //c a = w^2*jump + (1 - w^2)*u_n*n and the derivative of delta_eff w.r.t. the jump,
+    //c (w^2*u_t*m + u_n*n)/delta_eff, where u_t*m is the tangential jump; in mode I
+    //c (w = 0) these reduce to u_n*n and u_n*n/delta_eff. Written out per component so
+    //c that no inner loop is left for the if-conversion of the qp loop at -O2.
+    //c
+    T ax = u_n * nx;
+    T ay = u_n * ny;
+    T az = u_n * nz;
+    T dx = ax * inv_delta;
+    T dy = ay * inv_delta;
+    T dz = az * inv_delta;
+    if (mixed_mode)
+    {
+      ax = w2 * jump_x[q] + (1.0 - w2) * ax;
+      ay = w2 * jump_y[q] + (1.0 - w2) * ay;
+      az = w2 * jump_z[q] + (1.0 - w2) * az;
+      dx += w2 * u_t_x[q] * inv_delta;
+      dy += w2 * u_t_y[q] * inv_delta;
+      dz += w2 * u_t_z[q] * inv_delta;
+    }
+    const T c2 = T_effective * inv_delta;
+    traction_x[q] = c2 * ax;
+    traction_y[q] = c2 * ay;
+    traction_z[q] = c2 * az;
+    //c
+    //c the consistent tangent is s*da/djump + ds/ddelta_eff*a x ddelta_eff/djump, with
+    //c s = T_effective/delta_eff, da/djump = w^2*I + (1 - w^2)*n x n and
+    //c ds/ddelta_eff = -T_max/delta_eff^2 above delta_reg (and below delta_max), zero
+    //c otherwise. The selections pick between values, never guard arithmetic: a
+    //c guarded product may trap and blocks if-conversion.
+    //c
+    const T slope = delta_q >= delta_reg ? -T_max : T(0.0);
+    const T c1 = (T_effective > 0.0 ? slope : T(0.0)) * inv_delta * inv_delta;
+    const T p = (1.0 - w2) * c2;
+    const T d = w2 * c2;
+    k00[q] = c1 * ax * dx + p * nx * nx + d;
+    k01[q] = c1 * ax * dy + p * nx * ny;
+    k02[q] = c1 * ax * dz + p * nx * nz;
+    k10[q] = c1 * ay * dx + p * ny * nx;
+    k11[q] = c1 * ay * dy + p * ny * ny + d;
+    k12[q] = c1 * ay * dz + p * ny * nz;
+    k20[q] = c1 * az * dx + p * nz * nx;
+    k21[q] = c1 * az * dy + p * nz * ny;
+    k22[q] = c1 * az * dz + p * nz * nz + d;
+  }
+}
+}
+
+//c
+//c normal jump u_n and effective gap delta_eff = sqrt(u_n^2 + w^2*u_t^2) at every qp;
+//c the tangential jump vector and its norm u_t are only needed (and filled) in mixed mode
+//c
+template <bool mixed_mode, typename T>
+void
+computeKinematics(unsigned int begin,
+                  unsigned int end,
+                  const T * const jump[3],
+                  const T * const normal[3],
+                  T shear_weight,
+                  T * const u_t_vector[3],
+                  T * un,
+                  T * ut,
+                  T * delta)
+{
+  //c
+  //c the vectorized loop stores squared norms; the square roots follow
+  //c
+  detail::computeKinematics<mixed_mode>(begin,
+                                        end,
+                                        jump[0],
+                                        jump[1],
+                                        jump[2],
+                                        normal[0],
+                                        normal[1],
+                                        normal[2],
+                                        mixed_mode ? shear_weight * shear_weight : T(0.0),
+                                        u_t_vector[0],
+                                        u_t_vector[1],
+                                        u_t_vector[2],
+                                        un,
+                                        ut,
+                                        delta);
+  for (unsigned int q = begin; q < end; q++)
+  {
+    if (mixed_mode)
+      ut[q] = std::sqrt(ut[q]);
+    delta[q] = std::sqrt(delta[q]);
+  }
+}
+
+//c
+//c cohesive traction and its derivatives w.r.t. the jump at every qp. The traction is
+//c s(delta_eff)*a with s = T_effective/delta_eff, which carries T_max at any opening
+//c however small; its tangent grows like T_max/delta_eff. Below delta_reg the law is
+//c made linear, s = T_effective(delta_reg)/delta_reg, which bounds the tangent and makes
+//c the traction continuous at zero opening.
+//c
+template <bool mixed_mode, typename T>
+void
+computeCohesiveLaw(unsigned int begin,
+                   unsigned int end,
+                   const T * const jump[3],
+                   const T * const normal[3],
+                   const T * const u_t_vector[3],
+                   const T * un,
+                   const T * delta,
+                   T T_max,
+                   T delta_max,
+                   T delta_reg,
+                   T shear_weight,
+                   T * const traction[3],
+                   T * const tangent[3][3])
+{
+  detail::computeCohesiveLaw<mixed_mode>(begin,
+                                         end,
+                                         jump[0],
+                                         jump[1],
+                                         jump[2],
+                                         normal[0],
+                                         normal[1],
+                                         normal[2],
+                                         u_t_vector[0],
+                                         u_t_vector[1],
+                                         u_t_vector[2],
+                                         un,
+                                         delta,
+                                         T_max,
+                                         delta_max,
+                                         delta_reg,
+                                         mixed_mode ? shear_weight * shear_weight : T(0.0),
+                                         traction[0],
+                                         traction[1],
+                                         traction[2],
+                                         tangent[0][0],
+                                         tangent[0][1],
+                                         tangent[0][2],
+                                         tangent[1][0],
+                                         tangent[1][1],
+                                         tangent[1][2],
+                                         tangent[2][0],
+                                         tangent[2][1],
+                                         tangent[2][2]);
+}
+}